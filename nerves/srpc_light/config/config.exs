@@ -9,6 +9,10 @@ config :srpc_light, :srpc_file,
   ],
   name: "server.srpc"
 
+config :srpc_light, :nonce_filter,
+  ttl: 35,
+  bucket: 5
+
 config :stop_light, :cred_file,
   path: [
     device: "/root",
@@ -32,7 +36,6 @@ config :stop_light, :elli,
 config :kncache,
   caches: [
     srpc_exch: 30,
-    srpc_nonce: 35,
     srpc_conn: 300,
     srpc_reg: 3600,
     user_data: 300
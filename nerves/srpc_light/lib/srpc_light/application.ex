@@ -20,6 +20,7 @@ defmodule SrpcLight.Application do
       StopLight.Lights,
       StopLight.DevicePairing,
       StopLight.Login.Manager,
+      SrpcLight.NonceFilter,
       StopLight.Elli.ChildSpec.spec(:http),
       {:kncache, [caches]}
     ]
@@ -0,0 +1,99 @@
+defmodule SrpcLight.NonceFilter do
+  ## ===============================================================================================
+  ##
+  ##  Replay filter for request nonces
+  ##
+  ##    Nonces are held in a public ETS set tagged with the time bucket in which they were first
+  ##    seen. The test-and-insert is a single :ets.insert_new, so concurrent requests carrying the
+  ##    same nonce cannot both pass. Buckets older than the TTL are swept once per bucket interval,
+  ##    which bounds the table to roughly ttl + bucket seconds worth of nonces.
+  ##
+  ## ===============================================================================================
+  use GenServer
+
+  @table :srpc_nonce_filter
+
+  @default_ttl 35
+  @default_bucket 5
+
+  ## ===============================================================================================
+  ##
+  ##  Public API
+  ##
+  ## ===============================================================================================
+  ## -----------------------------------------------------------------------------------------------
+  ##  If the given nonce has not been seen within the TTL, record it and return true;
+  ##  O/W return false
+  ## -----------------------------------------------------------------------------------------------
+  def insert_new(nonce) do
+    :ets.insert_new(@table, {nonce, bucket(config(:bucket))})
+  end
+
+  ## ===============================================================================================
+  ##
+  ##  Client
+  ##
+  ## ===============================================================================================
+  ## -----------------------------------------------------------------------------------------------
+  ##  Child specification for starting server
+  ## -----------------------------------------------------------------------------------------------
+  def child_spec(_) do
+    %{id: __MODULE__, start: {__MODULE__, :start_link, []}}
+  end
+
+  ## -----------------------------------------------------------------------------------------------
+  ##
+  ## -----------------------------------------------------------------------------------------------
+  def start_link, do: GenServer.start_link(__MODULE__, [], name: __MODULE__)
+
+  ## -----------------------------------------------------------------------------------------------
+  ##  Init
+  ##    The owning process creates the table; request handlers read and write it directly.
+  ## -----------------------------------------------------------------------------------------------
+  def init(_args) do
+    :ets.new(@table, [:set, :public, :named_table, {:write_concurrency, true}])
+    bucket = config(:bucket)
+    schedule_sweep(bucket)
+    {:ok, [ttl: config(:ttl), bucket: bucket]}
+  end
+
+  ## ===============================================================================================
+  ##
+  ##  Info messages
+  ##
+  ## ===============================================================================================
+  ## -----------------------------------------------------------------------------------------------
+  ##  Sweep
+  ##    Drop every nonce whose bucket is entirely older than the TTL.
+  ## -----------------------------------------------------------------------------------------------
+  def handle_info(:sweep, state) do
+    ttl = state |> Keyword.get(:ttl)
+    bucket = state |> Keyword.get(:bucket)
+
+    expired = bucket(bucket) - div(ttl + bucket - 1, bucket)
+    :ets.select_delete(@table, [{{:_, :"$1"}, [{:<, :"$1", expired}], [true]}])
+
+    schedule_sweep(bucket)
+    {:noreply, state}
+  end
+
+  def handle_info(_, state), do: {:noreply, state}
+
+  ## ===============================================================================================
+  ##
+  ##  Private
+  ##
+  ## ===============================================================================================
+  defp schedule_sweep(bucket), do: :erlang.send_after(bucket * 1000, self(), :sweep)
+
+  defp bucket(bucket), do: Integer.floor_div(:erlang.monotonic_time(:second), bucket)
+
+  defp config(key) do
+    :srpc_light
+    |> Application.get_env(:nonce_filter, [])
+    |> Keyword.get(key, default(key))
+  end
+
+  defp default(:ttl), do: @default_ttl
+  defp default(:bucket), do: @default_bucket
+end
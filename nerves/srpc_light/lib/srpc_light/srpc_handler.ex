@@ -3,6 +3,9 @@ defmodule SrpcLight.SrpcHandler do
 
   alias StopLight.Login.Credentials
   alias StopLight.DevicePairing, as: Pairing
+  alias SrpcLight.NonceFilter
+
+  @registration :registration
 
   ## ================================================================================================
   ##
@@ -48,16 +51,36 @@ defmodule SrpcLight.SrpcHandler do
   ## ------------------------------------------------------------------------------------------------
   ##  Registration key/value
   ##    There is only one "user" of the device (determined by pairing action)
+  ##
+  ##    The decoded registration is held in the srpc_reg cache so repeated logins skip reading
+  ##    and decoding the credentials file. The file remains the source of truth: pairing removes
+  ##    it, so its existence is checked before the cache is consulted.
   ## ------------------------------------------------------------------------------------------------
   def put_registration(_user_id, value) do
-    value |> :erlang.term_to_binary() |> Pairing.set_credentials()
+    value
+    |> :erlang.term_to_binary()
+    |> Pairing.set_credentials()
+    |> case do
+      :ok -> :kncache.put(@registration, value, :srpc_reg)
+      _ -> :kncache.delete(@registration, :srpc_reg)
+    end
+
     :ok
   end
 
   def get_registration(_user_id) do
     if Credentials.exists?() do
-      {:ok, Credentials.read() |> :erlang.binary_to_term()}
+      case :kncache.get(@registration, :srpc_reg) do
+        :undefined ->
+          registration = Credentials.read() |> :erlang.binary_to_term()
+          :kncache.put(@registration, registration, :srpc_reg)
+          {:ok, registration}
+
+        {:ok, _registration} = cached ->
+          cached
+      end
     else
+      :kncache.delete(@registration, :srpc_reg)
       :undefined
     end
   end
@@ -72,16 +95,7 @@ defmodule SrpcLight.SrpcHandler do
   ##  If the given nonce is pure, store it and return true; O/W return false
   ##
   ## ------------------------------------------------------------------------------------------------
-  def nonce(nonce) do
-    case :kncache.get(nonce, :srpc_nonce) do
-      :undefined ->
-        :kncache.put(nonce, :erlang.system_time(:seconds), :srpc_nonce)
-        true
-
-      _ ->
-        false
-    end
-  end
+  def nonce(nonce), do: NonceFilter.insert_new(nonce)
 
   ## ------------------------------------------------------------------------------------------------
   ##